@@ -198,13 +198,11 @@ namespace codegen_detail {
     };
 }
 
-inline std::string generate_asm(const AstNode& ast, const CodegenOptions& options) {
+// Emit assembly for `ast` given its variables, already collected via collect_vars
+inline std::string generate_asm(const AstNode& ast, const std::unordered_set<std::string>& vars,
+                                const CodegenOptions& options) {
     using namespace codegen_detail;
 
-    // First pass: collect variables for .bss
-    std::unordered_set<std::string> vars;
-    collect_vars(ast, vars);
-
     Emitter E{options};
     for (const auto& v : vars) E.declare_var(v);
 
@@ -239,3 +237,10 @@ inline std::string generate_asm(const AstNode& ast, const CodegenOptions& option
 
     return out.str();
 }
+
+inline std::string generate_asm(const AstNode& ast, const CodegenOptions& options) {
+    // First pass: collect variables for .bss
+    std::unordered_set<std::string> vars;
+    codegen_detail::collect_vars(ast, vars);
+    return generate_asm(ast, vars, options);
+}
@@ -69,10 +69,6 @@ while(*p != '\0'){
 	}
 	// Append EOF once after tokenization
 	tokens.emplace_back(_EOF, "EOF");
-	// Debug print
-	for (const auto& token : tokens){
-		std::cout << "Token Type: " << token.t_type << ", Value: \"" << token.value << "\"\n";
-	}
 	return tokens;
 }
 
@@ -7,6 +7,7 @@
 #include "parser.hpp"
 #include "node.hpp"
 #include "codegen.hpp"
+#include "stats.hpp"
 
 // Helper display functions moved from parser.cpp
 static std::string token_type_to_string(token_t type){
@@ -45,6 +46,20 @@ static void display_hierarch(const AstNode& node, int indent){
     }
 }
 
+static void display_tokens(const TokenList& tokens){
+    for (const auto& tok : tokens){
+        std::cout << "Token(" << token_type_to_string(tok.t_type) << "): \"" << tok.value << "\"\n";
+    }
+}
+
+static std::size_t count_nodes(const AstNode& node){
+    std::size_t n = 1;
+    for (const auto& arg : node.args){
+        if (arg.node) n += count_nodes(*arg.node);
+    }
+    return n;
+}
+
 static std::string slurp_stdin_line(){
     std::string input;
     if (!std::getline(std::cin, input)) return std::string();
@@ -77,12 +92,15 @@ static void detect_defaults(CodegenOptions& opts){
 }
 
 int main(int argc, char** argv){
-    // CLI: bmath [input-file] [-o output-asm]
-    // If -o is provided, generate NASM assembly to file. Otherwise, print AST.
+    // CLI: bmath [input-file] [-o output-asm] [-v|-vv] [--stats]
+    // If -o is provided, generate NASM assembly to file. Otherwise, print it.
+    // -v dumps the AST, -vv also dumps tokens; --stats reports per-phase costs to stderr.
     std::string input;
     std::string input_path;
     std::string out_path; // assembly output, option
     std::string target;
+    int verbosity = 0;
+    bool want_stats = false;
 
     // Parse args (very simple)
     for (int i = 1; i < argc; ++i){
@@ -90,8 +108,14 @@ int main(int argc, char** argv){
         if (arg == "-o" && i + 1 < argc){
             out_path = argv[++i];
         } else if (arg == "-h" || arg == "--help"){
-            std::cout << "Usage: bmath [input-file] [-o output.asm]\n";
+            std::cout << "Usage: bmath [input-file] [-o output.asm] [-t target] [-v|-vv] [--stats]\n";
             return 0;
+        } else if (arg == "-v" || arg == "--verbose"){
+            ++verbosity;
+        } else if (arg == "-vv"){
+            verbosity += 2;
+        } else if (arg == "--stats" || arg == "--time-report"){
+            want_stats = true;
 	} else if ((arg == "-t" || arg == "--target") && i + 1 < argc){
 	    target = argv[++i];
         } else if (!arg.empty() && arg[0] == '-'){
@@ -102,23 +126,48 @@ int main(int argc, char** argv){
         }
     }
 
-    if (!input_path.empty()){
-        if (!read_file(input_path.c_str(), input)){
-            std::cerr << "Error: failed to open file: " << input_path << "\n";
-            return 1;
+    CompileStats stats;
+    CompileStats* sp = want_stats ? &stats : nullptr;
+
+    {
+        PhaseTimer t(sp, "read");
+        if (!input_path.empty()){
+            if (!read_file(input_path.c_str(), input)){
+                std::cerr << "Error: failed to open file: " << input_path << "\n";
+                return 1;
+            }
+        } else {
+            input = slurp_stdin_line();
         }
-    } else {
-        input = slurp_stdin_line();
-        if (input.empty()) return 0; // no input
     }
+    if (input.empty() && input_path.empty()) return 0; // no input
 
     // Tokenize and parse
-    TokenList tokens = tokenize(input.c_str());
-    AstNode ast = parse_prog(tokens);
+    TokenList tokens;
+    {
+        PhaseTimer t(sp, "lex");
+        tokens = tokenize(input.c_str());
+    }
+    stats.tokens = tokens.size();
+    if (verbosity >= 2) display_tokens(tokens);
 
+    AstNode ast(PROG, {});
+    {
+        PhaseTimer t(sp, "parse");
+        ast = parse_prog(tokens);
+    }
+    if (want_stats) stats.nodes = count_nodes(ast);
+    if (verbosity >= 1) display_hierarch(ast, 0);
+
+    std::unordered_set<std::string> vars;
+    {
+        PhaseTimer t(sp, "vars");
+        codegen_detail::collect_vars(ast, vars);
+    }
+    stats.vars = vars.size();
+
+    CodegenOptions opts; detect_defaults(opts);
     if (!out_path.empty()){
-        // Codegen to assembly file
-        CodegenOptions opts; detect_defaults(opts);
 	if(!target.empty()){
 		if(target == "win64"){
 			opts.arch = TargetArch::X64;
@@ -137,7 +186,17 @@ int main(int argc, char** argv){
 			return 1;
 		}
 	}
-        std::string asmText = generate_asm(ast, opts);
+    }
+
+    std::string asmText;
+    {
+        PhaseTimer t(sp, "codegen");
+        asmText = generate_asm(ast, vars, opts);
+    }
+    stats.asm_bytes = asmText.size();
+
+    if (!out_path.empty()){
+        // Codegen to assembly file
         std::ofstream ofs(out_path, std::ios::binary);
         if (!ofs){
             std::cerr << "Error: failed to open output file: " << out_path << "\n";
@@ -147,12 +206,10 @@ int main(int argc, char** argv){
         ofs.close();
         std::cout << "Wrote assembly to " << out_path << "\n";
     } else {
-        CodegenOptions opts; detect_defaults(opts);
-        std::string asmText = generate_asm(ast, opts);
-        
-        display_hierarch(ast, 0);
         std::cout << asmText << "\n";
     }
 
+    if (want_stats) stats.report(std::cerr);
+
     return 0;
 }
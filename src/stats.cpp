@@ -0,0 +1,87 @@
+#include "stats.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#ifdef _WIN32
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// The compiler is single-threaded, so plain counters are enough
+static std::size_t g_alloc_count = 0;
+static std::size_t g_alloc_bytes = 0;
+
+void* operator new(std::size_t size){
+    ++g_alloc_count;
+    g_alloc_bytes += size;
+    if (size == 0) size = 1;
+    void* p = std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept{
+    std::free(p);
+}
+
+AllocCounters alloc_counters(){
+    AllocCounters c;
+    c.count = g_alloc_count;
+    c.bytes = g_alloc_bytes;
+    return c;
+}
+
+std::size_t peak_rss_bytes(){
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0;
+    return pmc.PeakWorkingSetSize;
+#else
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<std::size_t>(ru.ru_maxrss); // bytes
+#else
+    return static_cast<std::size_t>(ru.ru_maxrss) * 1024; // kilobytes
+#endif
+#endif
+}
+
+void CompileStats::report(std::ostream& os) const{
+    double total_ms = 0.0;
+    AllocCounters total;
+    os << "=== bmath stats ===\n";
+    os << std::left << std::setw(10) << "phase"
+       << std::right << std::setw(12) << "time (ms)"
+       << std::setw(10) << "allocs"
+       << std::setw(14) << "alloc bytes" << "\n";
+    for (const auto& ps : phases){
+        os << std::left << std::setw(10) << ps.name
+           << std::right << std::setw(12) << std::fixed << std::setprecision(3) << ps.ms
+           << std::setw(10) << ps.allocs.count
+           << std::setw(14) << ps.allocs.bytes << "\n";
+        total_ms += ps.ms;
+        total.count += ps.allocs.count;
+        total.bytes += ps.allocs.bytes;
+    }
+    os << std::left << std::setw(10) << "total"
+       << std::right << std::setw(12) << std::fixed << std::setprecision(3) << total_ms
+       << std::setw(10) << total.count
+       << std::setw(14) << total.bytes << "\n";
+
+    AllocCounters process = alloc_counters();
+    os << "tokens:        " << tokens << "\n";
+    os << "nodes:         " << nodes << "\n";
+    os << "variables:     " << vars << "\n";
+    os << "asm bytes:     " << asm_bytes << "\n";
+    os << "heap allocs:   " << process.count << " (" << process.bytes << " bytes, whole process)\n";
+    os << "peak RSS:      " << peak_rss_bytes() / 1024 << " KiB\n";
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Compile statistics for `--stats` / `--time-report`
+// - Wall time and heap allocations per compiler phase
+// - Allocations are counted by the replacement operator new in stats.cpp
+// - Peak RSS is read from the OS once at report time
+
+struct AllocCounters {
+    std::size_t count{0};
+    std::size_t bytes{0};
+};
+
+// Snapshot of the process-wide allocation counters
+AllocCounters alloc_counters();
+
+// Peak resident set size in bytes, 0 if unavailable
+std::size_t peak_rss_bytes();
+
+struct PhaseStat {
+    std::string name;
+    double ms{0.0};
+    AllocCounters allocs;
+};
+
+struct CompileStats {
+    std::vector<PhaseStat> phases;
+    std::size_t tokens{0};
+    std::size_t nodes{0};
+    std::size_t vars{0};
+    std::size_t asm_bytes{0};
+
+    void report(std::ostream& os) const;
+};
+
+// Times a phase from construction to destruction and records it in `stats`.
+// A null `stats` makes this a no-op, so phases cost nothing extra when off.
+class PhaseTimer {
+public:
+    PhaseTimer(CompileStats* stats, const char* name)
+        : stats_(stats), name_(name) {
+        if (!stats_) return;
+        allocs_ = alloc_counters();
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~PhaseTimer() {
+        if (!stats_) return;
+        auto end = std::chrono::steady_clock::now();
+        AllocCounters now = alloc_counters();
+        PhaseStat ps;
+        ps.name = name_;
+        ps.ms = std::chrono::duration<double, std::milli>(end - start_).count();
+        ps.allocs.count = now.count - allocs_.count;
+        ps.allocs.bytes = now.bytes - allocs_.bytes;
+        stats_->phases.push_back(ps);
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    CompileStats* stats_;
+    const char* name_;
+    AllocCounters allocs_;
+    std::chrono::steady_clock::time_point start_;
+};